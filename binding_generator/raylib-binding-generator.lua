@@ -59,6 +59,10 @@ local raymath_result = converters.convert(raymath_table)
 table.insert(final_result, '\n\n-- raymath binding: \n')
 table.insert(final_result, 'global Raymath = @record{}\n')
 
+-- the cimport'ed raymath.h functions are the default backend,
+-- see the "raymath inline backend" below
+table.insert(final_result, '## if not RAYMATH_INLINE then\n')
+
 for i = 1, #raymath_result do
   table.insert(final_result, raymath_result[i])
 end
@@ -255,18 +259,108 @@ for i, line in ipairs(final_result) do
   end
 end
 
+-- [ raymath inline backend [
+-- when RAYMATH_INLINE is defined (e.g. `nelua -DRAYMATH_INLINE game.nelua`), the raymath.h functions
+-- are replaced by <inline> Nelua ports of their bodies, so the C compiler sees them as local code
+local raymath_inline_file = io.open('binding_generator/raymath-inline.nelua', 'r')
+local raymath_inline_code = raymath_inline_file:read('a')
+raymath_inline_file:close()
+
+table.insert(final_result, '## else\n')
+table.insert(final_result, raymath_inline_code)
+table.insert(final_result, '\n-- raymath inline methods:\n')
+
+-- generates the record methods (e.g. "Vector2.Add"), just like apply_methods does for the cimport backend
+local raymath_method_records = {'Vector2', 'Vector3', 'Matrix', 'Quaternion'}
+
+for func_name, params, ret_type in string.gmatch(raymath_inline_code, 'function Raymath%.(%w+)(%b())(: [^<]-) <inline>') do
+  for _, record in ipairs(raymath_method_records) do
+    local method_name = string.match(func_name, '^' .. record .. '(.+)')
+
+    if method_name then
+      local args = string.gsub(params:sub(2, -2), ':%s*[^,]+', '')
+      local call = 'Raymath.' .. func_name .. '(' .. args .. ')'
+
+      if ret_type ~= ': void' then
+        call = 'return ' .. call
+      end
+
+      table.insert(final_result, string.format('function %s.%s%s%s <inline> %s end\n', record, method_name, params, ret_type, call))
+      break
+    end
+  end
+end
+
+table.insert(final_result, '## end\n\n')
+-- ] raymath inline backend ]
+
+-- [ in-place and out-parameter variants [
+-- "Into" variants write the result to an out pointer and take Matrix/Quaternion by pointer
+-- (e.g. "Matrix.MultiplyInto(out: *Matrix, left: *Matrix, right: *Matrix)"), "InPlace" variants
+-- replace the first argument (e.g. "Vector3:AddInPlace(v2: Vector3)"), both on top of the methods
+-- above, so they work with any raymath backend
+-- NOTE: they call the methods above, so with the cimport backend the Matrix/Quaternion arguments and
+-- results are still copied by value to and from raymath.h, the copies can only go away when the
+-- RAYMATH_INLINE Nelua ports are inlined in the caller
+local raymath_pointer_types = {Matrix = true, Quaternion = true}
+local raymath_variants_records = {Vector2 = true, Vector3 = true, Matrix = true, Quaternion = true}
+
+-- returns the params with Matrix/Quaternion by pointer, the call arguments and the type of the first param
+local function raymath_pointer_params(params)
+  local new_params, args, first_type = {}, {}, nil
+
+  for name, param_type in string.gmatch(params:sub(2, -2), '(%w+): ([%w%*]+)') do
+    first_type = first_type or param_type
+
+    if raymath_pointer_types[param_type] then
+      table.insert(new_params, name .. ': *' .. param_type)
+      table.insert(args, '$' .. name)
+    else
+      table.insert(new_params, name .. ': ' .. param_type)
+      table.insert(args, name)
+    end
+  end
+
+  return new_params, args, first_type
+end
+
+local raymath_variants = {'-- in-place and out-parameter variants (they skip the Matrix/Quaternion copies with RAYMATH_INLINE only):\n'}
+
+for record, method, params, ret_type in string.gmatch(table.concat(final_result), '\nfunction (%w+)%.(%w+)(%b())(: [%w%*]+) <cimport') do
+  ret_type = ret_type:sub(3)
+
+  if raymath_variants_records[record] and raymath_variants_records[ret_type] and params ~= '()' then
+    local new_params, args, first_type = raymath_pointer_params(params)
+    local call = string.format('%s.%s(%s)', record, method, table.concat(args, ', '))
+
+    if raymath_pointer_types[ret_type] or string.find(params, 'Matrix') or string.find(params, 'Quaternion') then
+      table.insert(raymath_variants, string.format('function %s.%sInto(out: *%s, %s): void <inline> $out = %s end\n',
+        record, method, ret_type, table.concat(new_params, ', '), call))
+    end
+
+    if first_type == record and ret_type == record then
+      local self_call = string.format('%s.%s(%s)', record, method, table.concat({'$self', table.unpack(args, 2)}, ', '))
+      table.insert(raymath_variants, string.format('function %s:%sInPlace(%s): void <inline> $self = %s end\n',
+        record, method, table.concat(new_params, ', ', 2), self_call))
+    end
+  end
+end
+
+table.insert(final_result, table.concat(raymath_variants) .. '\n')
+-- ] in-place and out-parameter variants ]
+
 table.insert(final_result, [[
 -- [ operator overloading [
 
 -- [ Vector2 [
 -- Add two vectors (v1 + v2)
-function Vector2.__add(v1: Vector2, v2: Vector2): Vector2 <cimport'Vector2Add', nodecl> end
+function Vector2.__add(v1: Vector2, v2: Vector2): Vector2 <inline> return Vector2.Add(v1, v2) end
 -- Subtract two vectors (v1 - v2)
-function Vector2.__sub(v1: Vector2, v2: Vector2): Vector2 <cimport'Vector2Subtract', nodecl> end
+function Vector2.__sub(v1: Vector2, v2: Vector2): Vector2 <inline> return Vector2.Subtract(v1, v2) end
 -- Calculate vector length
-function Vector2.__len(v: Vector2): float32 <cimport'Vector2Length', nodecl> end
+function Vector2.__len(v: Vector2): float32 <inline> return Vector2.Length(v) end
 -- Negate vector
-function Vector2.__unm(v: Vector2): Vector2 <cimport'Vector2Negate', nodecl> end
+function Vector2.__unm(v: Vector2): Vector2 <inline> return Vector2.Negate(v) end
 -- Divide vector by a float value or vector
 function Vector2.__div(v: Vector2, divisor: overload(Vector2, number)): Vector2
   ## if divisor.type.is_vector2 then
@@ -287,17 +381,17 @@ end
 
 -- [ Vector3 [
 -- Add two vectors
-function Vector3.__add(v1: Vector3, v2: Vector3): Vector3 <cimport'Vector3Add', nodecl> end
+function Vector3.__add(v1: Vector3, v2: Vector3): Vector3 <inline> return Vector3.Add(v1, v2) end
 -- Subtract two vectors
-function Vector3.__sub(v1: Vector3, v2: Vector3): Vector3 <cimport'Vector3Subtract', nodecl> end
+function Vector3.__sub(v1: Vector3, v2: Vector3): Vector3 <inline> return Vector3.Subtract(v1, v2) end
 -- Calculate vector length
-function Vector3.__len(v: Vector3): float32 <cimport'Vector3Length', nodecl> end
+function Vector3.__len(v: Vector3): float32 <inline> return Vector3.Length(v) end
 -- Negate provided vector (invert direction)
-function Vector3.__unm(v: Vector3): Vector3 <cimport'Vector3Negate', nodecl> end
+function Vector3.__unm(v: Vector3): Vector3 <inline> return Vector3.Negate(v) end
 -- Multiply vector by scalar or by vector
 function Vector3.__mul(v: Vector3, multiplier: overload(Vector3, number)): Vector3
   ## if multiplier.type.is_vector3 then
-    return Vector3.MultiplyV(v, multiplier)
+    return Vector3.Multiply(v, multiplier)
   ## else
     return Vector3.Scale(v, multiplier)
   ## end
@@ -314,22 +408,90 @@ end
 
 -- [ Matrix [
 -- Add two matrices
-function Matrix.__add(left: Matrix, right: Matrix): Matrix <cimport'MatrixAdd', nodecl> end
+function Matrix.__add(left: Matrix, right: Matrix): Matrix <inline> return Matrix.Add(left, right) end
 -- Subtract two matrices (left - right)
-function Matrix.__sub(left: Matrix, right: Matrix): Matrix <cimport'MatrixSubtract', nodecl> end
+function Matrix.__sub(left: Matrix, right: Matrix): Matrix <inline> return Matrix.Subtract(left, right) end
 -- Returns two matrix multiplication
 -- NOTE: When multiplying matrices... the order matters!
-function Matrix.__mul(left: Matrix, right: Matrix): Matrix <cimport'MatrixMultiply', nodecl> end
+function Matrix.__mul(left: Matrix, right: Matrix): Matrix <inline> return Matrix.Multiply(left, right) end
 -- ] Matrix ]
 
 -- [ Quaternion [
 -- Computes the length of a quaternion
-function Quaternion.__len(q: Quaternion): float32 <cimport'QuaternionLength', nodecl> end
+function Quaternion.__len(q: Quaternion): float32 <inline> return Quaternion.Length(q) end
 -- Calculate two quaternion multiplication
-function Quaternion.__mul(q1: Quaternion, q2: Quaternion): Quaternion <cimport'QuaternionMultiply', nodecl> end
+function Quaternion.__mul(q1: Quaternion, q2: Quaternion): Quaternion <inline> return Quaternion.Multiply(q1, q2) end
 -- ] Quaternion ]
 
 -- ] operator overloading ]
+
+-- [ fused operations [
+-- Fused versions of common operator chains (multiply-add, scaled add), they do the same
+-- operations in the same order of the chained operators, so results are identical,
+-- but without passing and returning the intermediate vectors.
+-- NOTE: results are identical only while the C compiler doesn't contract a*b + c into a
+-- fused multiply-add instruction, GCC does it by default when FMA is enabled (-mfma, -march=native),
+-- in that case the fused and the chained versions can differ on the last bit, compile
+-- with -ffp-contract=off to keep them identical:
+--   Vector3.Fma(a, s, c)         a*s + c (s can be a number or a Vector3)
+--   Vector3.Fma2(a, s, b, t, c)  a*s + b*t + c
+--   Vector3.AddScaled(a, b, s)   a + b*s
+--   v:AddScaledInPlace(b, s)     v = v + b*s
+-- NOTE: lerp is already fused as Vector3.Lerp(v1, v2, amount)
+
+-- [ Vector2 [
+function Raymath.Vector2Fma(a: Vector2, s: overload(Vector2, number), c: Vector2): Vector2 <inline>
+  ## if s.type.is_vector2 then
+    local result: Vector2 = { a.x*s.x + c.x, a.y*s.y + c.y }
+    return result
+  ## else
+    local scale: float32 = s
+    local result: Vector2 = { a.x*scale + c.x, a.y*scale + c.y }
+    return result
+  ## end
+end
+function Raymath.Vector2Fma2(a: Vector2, s: float32, b: Vector2, t: float32, c: Vector2): Vector2 <inline>
+  local result: Vector2 = { a.x*s + b.x*t + c.x, a.y*s + b.y*t + c.y }
+  return result
+end
+function Raymath.Vector2AddScaled(a: Vector2, b: Vector2, s: float32): Vector2 <inline>
+  local result: Vector2 = { a.x + b.x*s, a.y + b.y*s }
+  return result
+end
+
+function Vector2.Fma(a: Vector2, s: overload(Vector2, number), c: Vector2): Vector2 <inline> return Raymath.Vector2Fma(a, s, c) end
+function Vector2.Fma2(a: Vector2, s: float32, b: Vector2, t: float32, c: Vector2): Vector2 <inline> return Raymath.Vector2Fma2(a, s, b, t, c) end
+function Vector2.AddScaled(a: Vector2, b: Vector2, s: float32): Vector2 <inline> return Raymath.Vector2AddScaled(a, b, s) end
+function Vector2:AddScaledInPlace(b: Vector2, s: float32): void <inline> $self = Raymath.Vector2AddScaled($self, b, s) end
+-- ] Vector2 ]
+
+-- [ Vector3 [
+function Raymath.Vector3Fma(a: Vector3, s: overload(Vector3, number), c: Vector3): Vector3 <inline>
+  ## if s.type.is_vector3 then
+    local result: Vector3 = { a.x*s.x + c.x, a.y*s.y + c.y, a.z*s.z + c.z }
+    return result
+  ## else
+    local scale: float32 = s
+    local result: Vector3 = { a.x*scale + c.x, a.y*scale + c.y, a.z*scale + c.z }
+    return result
+  ## end
+end
+function Raymath.Vector3Fma2(a: Vector3, s: float32, b: Vector3, t: float32, c: Vector3): Vector3 <inline>
+  local result: Vector3 = { a.x*s + b.x*t + c.x, a.y*s + b.y*t + c.y, a.z*s + b.z*t + c.z }
+  return result
+end
+function Raymath.Vector3AddScaled(a: Vector3, b: Vector3, s: float32): Vector3 <inline>
+  local result: Vector3 = { a.x + b.x*s, a.y + b.y*s, a.z + b.z*s }
+  return result
+end
+
+function Vector3.Fma(a: Vector3, s: overload(Vector3, number), c: Vector3): Vector3 <inline> return Raymath.Vector3Fma(a, s, c) end
+function Vector3.Fma2(a: Vector3, s: float32, b: Vector3, t: float32, c: Vector3): Vector3 <inline> return Raymath.Vector3Fma2(a, s, b, t, c) end
+function Vector3.AddScaled(a: Vector3, b: Vector3, s: float32): Vector3 <inline> return Raymath.Vector3AddScaled(a, b, s) end
+function Vector3:AddScaledInPlace(b: Vector3, s: float32): void <inline> $self = Raymath.Vector3AddScaled($self, b, s) end
+-- ] Vector3 ]
+
+-- ] fused operations ]
 ]])
 
 --] raymath.h ]